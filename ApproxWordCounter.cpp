@@ -0,0 +1,331 @@
+/**
+ * ApproxWordCounter.cpp
+ *
+ * Implementations for the ApproxWordCounter class and nested struct
+ * HeavyHitter. The ApproxWordCounter class counts words in fixed
+ * memory, trading exact counts for a bounded error. Frequencies are
+ * estimated with a Count-Min Sketch and the most frequent words are
+ * tracked, by those estimates, in a min-heap of heavy hitters.
+ *
+ * Joshua Scheck
+ * 2026-10-18
+ */
+
+#include "ApproxWordCounter.h"
+#include "WordTokenizer.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+/**
+ * Constructor for ApproxWordCounter class, which initializes an
+ * empty ApproxWordCounter
+ *
+ * @pre                  width, depth and numHitters are positive
+ *
+ * @param   width        number of counters in each row of the
+ *                       Count-Min Sketch
+ * @param   depth        number of rows in the Count-Min Sketch
+ * @param   numHitters   number of words tracked as heavy hitters
+ *
+ * @throws  std::invalid_argument if width, depth or numHitters
+ *          is not positive
+ */
+ApproxWordCounter::ApproxWordCounter(int width, int depth,
+   int numHitters) : width(width), depth(depth),
+   numHitters(numHitters), total(0),
+   sketch() {
+
+   if (width <= 0 || depth <= 0 || numHitters <= 0) {
+      throw std::invalid_argument(
+         "ApproxWordCounter sizes must be positive");
+   }
+
+   // hitters grows only as distinct words are seen, so a large
+   // numHitters costs nothing up front
+   sketch.assign(static_cast<std::size_t>(width) * depth, 0);
+}
+
+/**
+ * Counts one more occurrence of the provided word. The word is
+ * counted exactly as it is given, like WordTree::insert.
+ *
+ * @post             Count-Min Sketch and heavy hitters are updated
+ *                   with aWord
+ *
+ * @param   aWord    word to count
+ */
+void ApproxWordCounter::insert(const std::string& aWord) {
+   std::uint64_t wordHash = hash(aWord);
+
+   for (int row = 0; row < depth; row++) {
+      sketch[cell(wordHash, row)]++;
+   }
+   total++;
+
+   addHitter(aWord, estimate(wordHash));
+}
+
+/**
+ * Estimates the number of times the provided word was counted.
+ * The estimate is never lower than the true count, and with
+ * probability 1 - failureProbability() it is at most
+ * errorBound() higher than the true count.
+ *
+ * @post             state of this ApproxWordCounter does not
+ *                   change
+ *
+ * @param   aWord    word to estimate
+ *
+ * @return           estimated count of aWord
+ */
+long long ApproxWordCounter::estimate(const std::string& aWord) const {
+   return estimate(hash(aWord));
+}
+
+/**
+ * Retrieves the tracked heavy hitters sorted from most to least
+ * frequent. Each count is subject to the same error bound as
+ * estimate().
+ *
+ * @post     state of this ApproxWordCounter does not change
+ *
+ * @return   heavy hitters
+ */
+std::vector<ApproxWordCounter::HeavyHitter>
+   ApproxWordCounter::topWords() const {
+
+   std::vector<HeavyHitter> words(hitters);
+
+   std::sort(words.begin(), words.end(),
+      [](const HeavyHitter& lhs, const HeavyHitter& rhs) {
+         if (lhs.count != rhs.count) {
+            return lhs.count > rhs.count;
+         }
+         return lhs.item < rhs.item;
+      });
+
+   return words;
+}
+
+/**
+ * Retrieves the total number of words counted
+ *
+ * @return  total number of words counted
+ */
+long long ApproxWordCounter::numWords() const {
+   return total;
+}
+
+/**
+ * Retrieves the additive error bound of estimate(), which is
+ * e / width * numWords()
+ *
+ * @return  additive error bound of estimate()
+ */
+double ApproxWordCounter::errorBound() const {
+   return std::exp(1.0) / width * total;
+}
+
+/**
+ * Retrieves the probability that an estimate() exceeds
+ * errorBound(), which is e ^ -depth
+ *
+ * @return  failure probability of errorBound()
+ */
+double ApproxWordCounter::failureProbability() const {
+   return std::exp(-static_cast<double>(depth));
+}
+
+/**
+ * Private helper method that hashes the provided word with 64-bit
+ * FNV-1a followed by a final avalanche step
+ *
+ * @param   aWord    word to hash
+ *
+ * @return           64-bit hash of aWord
+ */
+std::uint64_t ApproxWordCounter::hash(const std::string& aWord) {
+   std::uint64_t wordHash = 14695981039346656037ULL;
+
+   for (char currChar : aWord) {
+      wordHash ^= static_cast<unsigned char>(currChar);
+      wordHash *= 1099511628211ULL;
+   }
+
+   wordHash ^= wordHash >> 33;
+   wordHash *= 0xff51afd7ed558ccdULL;
+   wordHash ^= wordHash >> 33;
+   return wordHash;
+}
+
+/**
+ * Private helper method that retrieves the Count-Min Sketch cell
+ * for the provided hash in the provided row. Each row uses its own
+ * hash, derived from the two halves of wordHash.
+ *
+ * @param   wordHash hash of the word
+ * @param   row      row of the Count-Min Sketch
+ *
+ * @return           index of the cell in sketch
+ */
+std::size_t ApproxWordCounter::cell(std::uint64_t wordHash,
+   int row) const {
+
+   std::uint32_t low = static_cast<std::uint32_t>(wordHash);
+   std::uint32_t high = static_cast<std::uint32_t>(wordHash >> 32);
+   std::uint32_t rowHash = low + static_cast<std::uint32_t>(row) *
+      (high | 1);
+
+   return static_cast<std::size_t>(row) * width + rowHash % width;
+}
+
+/**
+ * Private helper method that estimates a count from the
+ * Count-Min Sketch using an already computed hash
+ *
+ * @param   wordHash hash of the word
+ *
+ * @return           estimated count
+ */
+long long ApproxWordCounter::estimate(std::uint64_t wordHash) const {
+   long long count = total;
+
+   for (int row = 0; row < depth; row++) {
+      count = std::min<long long>(count, sketch[cell(wordHash, row)]);
+   }
+
+   return count;
+}
+
+/**
+ * Private helper method that updates the heavy hitters with the
+ * new estimate of the provided word. Once all heavy hitters are
+ * in use, the word replaces the least frequent heavy hitter if
+ * its estimate is larger.
+ *
+ * @param   aWord    word that was counted
+ * @param   count    new estimate of aWord
+ */
+void ApproxWordCounter::addHitter(const std::string& aWord,
+   long long count) {
+
+   auto found = hitterIndex.find(aWord);
+
+   // estimates only grow, so an updated HeavyHitter can only need
+   // to move down the min-heap
+   if (found != hitterIndex.end()) {
+      hitters[found->second].count = count;
+      siftDown(found->second);
+   }
+   else if (hitters.size() < static_cast<std::size_t>(numHitters)) {
+      hitters.push_back(HeavyHitter{aWord, count});
+      hitterIndex[aWord] = hitters.size() - 1;
+      for (std::size_t idx = hitters.size() - 1; idx > 0 &&
+         hitters[(idx - 1) / 2].count > hitters[idx].count;
+         idx = (idx - 1) / 2) {
+         swapHitters(idx, (idx - 1) / 2);
+      }
+   }
+   else if (count > hitters.front().count) {
+      hitterIndex.erase(hitters.front().item);
+      hitters.front() = HeavyHitter{aWord, count};
+      hitterIndex[aWord] = 0;
+      siftDown(0);
+   }
+}
+
+/**
+ * Private helper method that restores the min-heap order of
+ * hitters by moving the HeavyHitter at the provided index down
+ *
+ * @param   idx      index of the HeavyHitter in hitters
+ */
+void ApproxWordCounter::siftDown(std::size_t idx) {
+   std::size_t size = hitters.size();
+
+   while (true) {
+      std::size_t smallest = idx;
+      std::size_t left = 2 * idx + 1;
+      std::size_t right = 2 * idx + 2;
+
+      if (left < size && hitters[left].count < hitters[smallest].count) {
+         smallest = left;
+      }
+      if (right < size &&
+         hitters[right].count < hitters[smallest].count) {
+         smallest = right;
+      }
+      if (smallest == idx) {
+         return;
+      }
+
+      swapHitters(idx, smallest);
+      idx = smallest;
+   }
+}
+
+/**
+ * Private helper method that swaps two HeavyHitters in hitters
+ * and updates hitterIndex
+ *
+ * @param   first    index of the first HeavyHitter
+ * @param   second   index of the second HeavyHitter
+ */
+void ApproxWordCounter::swapHitters(std::size_t first,
+   std::size_t second) {
+
+   std::swap(hitters[first], hitters[second]);
+   hitterIndex[hitters[first].item] = first;
+   hitterIndex[hitters[second].item] = second;
+}
+
+/**
+ * Overloads the output stream operator for use with
+ * ApproxWordCounter objects. Outputs the tracked heavy hitters, from
+ * most to least frequent, with their estimated counts.
+ *
+ * @pre              ApproxWordCounter must be initialized
+ *
+ * @post             heavy hitters of this ApproxWordCounter are sent
+ *                   to output stream
+ *
+ * @param   output   output to stream this ApproxWordCounter to
+ *
+ * @param   counter  this ApproxWordCounter object
+ *
+ * @return           output stream
+ */
+std::ostream& operator<<(std::ostream& output,
+   const ApproxWordCounter& counter) {
+
+   for (const ApproxWordCounter::HeavyHitter& word :
+      counter.topWords()) {
+      output << word.item << " " << word.count << "\n";
+   }
+   return output;
+}
+
+/**
+ * Overloads the input stream operator for use with
+ * ApproxWordCounter objects. Allows for input stream to stream words
+ * into this ApproxWordCounter.
+ *
+ * Words are read with WordTokenizer<DefaultWordPolicy>, the same
+ * word rules used by WordTree
+ *
+ * @pre              ApproxWordCounter must be initialized
+ *
+ * @post             Words from input stream are counted by this
+ *                   ApproxWordCounter
+ *
+ * @param   input    input to stream into this ApproxWordCounter
+ *
+ * @param   counter  reference to this ApproxWordCounter object
+ *
+ * @return           input stream
+ */
+std::istream& operator>>(std::istream& input,
+   ApproxWordCounter& counter) {
+   return WordTokenizer<DefaultWordPolicy>::read(input, counter);
+} // end ApproxWordCounter.cpp
@@ -0,0 +1,231 @@
+/**
+ * ApproxWordCounter.h
+ *
+ * Declarations for the ApproxWordCounter class and nested struct
+ * HeavyHitter. The ApproxWordCounter class counts words in fixed
+ * memory, trading exact counts for a bounded error. Frequencies are
+ * estimated with a Count-Min Sketch and the most frequent words are
+ * tracked, by those estimates, in a min-heap of heavy hitters.
+ *
+ * Joshua Scheck
+ * 2026-10-18
+ */
+
+#pragma once
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class ApproxWordCounter {
+
+public:
+
+   /**
+    * HeavyHitter structure which represents one of the most
+    * frequent words
+    */
+   struct HeavyHitter {
+
+      /** Word stored in this HeavyHitter */
+      std::string item;
+      /** Count-Min Sketch estimate of the frequency of the stored
+       * word */
+      long long count;
+   };
+
+   /**
+    * Constructor for ApproxWordCounter class, which initializes an
+    * empty ApproxWordCounter
+    *
+    * @pre                  width, depth and numHitters are positive
+    *
+    * @param   width        number of counters in each row of the
+    *                       Count-Min Sketch
+    * @param   depth        number of rows in the Count-Min Sketch
+    * @param   numHitters   number of words tracked as heavy hitters
+    *
+    * @throws  std::invalid_argument if width, depth or numHitters
+    *          is not positive
+    */
+   ApproxWordCounter(int width = 4096, int depth = 4,
+      int numHitters = 100);
+
+   /**
+    * Counts one more occurrence of the provided word. The word is
+    * counted exactly as it is given, like WordTree::insert.
+    *
+    * @post             Count-Min Sketch and heavy hitters are updated
+    *                   with aWord
+    *
+    * @param   aWord    word to count
+    */
+   void insert(const std::string& aWord);
+
+   /**
+    * Estimates the number of times the provided word was counted.
+    * The estimate is never lower than the true count, and with
+    * probability 1 - failureProbability() it is at most
+    * errorBound() higher than the true count.
+    *
+    * @post             state of this ApproxWordCounter does not
+    *                   change
+    *
+    * @param   aWord    word to estimate
+    *
+    * @return           estimated count of aWord
+    */
+   long long estimate(const std::string& aWord) const;
+
+   /**
+    * Retrieves the tracked heavy hitters sorted from most to least
+    * frequent. Each count is subject to the same error bound as
+    * estimate().
+    *
+    * @post     state of this ApproxWordCounter does not change
+    *
+    * @return   heavy hitters
+    */
+   std::vector<HeavyHitter> topWords() const;
+
+   /**
+    * Retrieves the total number of words counted
+    *
+    * @return  total number of words counted
+    */
+   long long numWords() const;
+
+   /**
+    * Retrieves the additive error bound of estimate(), which is
+    * e / width * numWords()
+    *
+    * @return  additive error bound of estimate()
+    */
+   double errorBound() const;
+
+   /**
+    * Retrieves the probability that an estimate() exceeds
+    * errorBound(), which is e ^ -depth
+    *
+    * @return  failure probability of errorBound()
+    */
+   double failureProbability() const;
+
+private:
+   /**
+    * Private helper method that hashes the provided word
+    *
+    * @param   aWord    word to hash
+    *
+    * @return           64-bit hash of aWord
+    */
+   static std::uint64_t hash(const std::string& aWord);
+
+   /**
+    * Private helper method that retrieves the Count-Min Sketch cell
+    * for the provided hash in the provided row
+    *
+    * @param   wordHash hash of the word
+    * @param   row      row of the Count-Min Sketch
+    *
+    * @return           index of the cell in sketch
+    */
+   std::size_t cell(std::uint64_t wordHash, int row) const;
+
+   /**
+    * Private helper method that estimates a count from the
+    * Count-Min Sketch using an already computed hash
+    *
+    * @param   wordHash hash of the word
+    *
+    * @return           estimated count
+    */
+   long long estimate(std::uint64_t wordHash) const;
+
+   /**
+    * Private helper method that updates the heavy hitters with the
+    * new estimate of the provided word. Once all heavy hitters are
+    * in use, the word replaces the least frequent heavy hitter if
+    * its estimate is larger.
+    *
+    * @param   aWord    word that was counted
+    * @param   count    new estimate of aWord
+    */
+   void addHitter(const std::string& aWord, long long count);
+
+   /**
+    * Private helper method that restores the min-heap order of
+    * hitters by moving the HeavyHitter at the provided index down
+    *
+    * @param   idx      index of the HeavyHitter in hitters
+    */
+   void siftDown(std::size_t idx);
+
+   /**
+    * Private helper method that swaps two HeavyHitters in hitters
+    * and updates hitterIndex
+    *
+    * @param   first    index of the first HeavyHitter
+    * @param   second   index of the second HeavyHitter
+    */
+   void swapHitters(std::size_t first, std::size_t second);
+
+   /** number of counters in each row of the Count-Min Sketch */
+   int width;
+   /** number of rows in the Count-Min Sketch */
+   int depth;
+   /** number of words tracked as heavy hitters */
+   int numHitters;
+   /** total number of words counted */
+   long long total;
+   /** Count-Min Sketch counters, depth rows of width counters,
+    * 64 bits wide so they cannot wrap before total does */
+   std::vector<std::uint64_t> sketch;
+   /** heavy hitters, kept as a min-heap on count */
+   std::vector<HeavyHitter> hitters;
+   /** index into hitters of each tracked word */
+   std::unordered_map<std::string, std::size_t> hitterIndex;
+};
+
+/**
+ * Overloads the output stream operator for use with
+ * ApproxWordCounter objects. Outputs the tracked heavy hitters, from
+ * most to least frequent, with their estimated counts.
+ *
+ * @pre              ApproxWordCounter must be initialized
+ *
+ * @post             heavy hitters of this ApproxWordCounter are sent
+ *                   to output stream
+ *
+ * @param   output   output to stream this ApproxWordCounter to
+ *
+ * @param   counter  this ApproxWordCounter object
+ *
+ * @return           output stream
+ */
+std::ostream& operator<<(std::ostream& output,
+   const ApproxWordCounter& counter);
+
+/**
+ * Overloads the input stream operator for use with
+ * ApproxWordCounter objects. Allows for input stream to stream words
+ * into this ApproxWordCounter.
+ *
+ * Words are read with WordTokenizer<DefaultWordPolicy>, the same
+ * word rules used by WordTree
+ *
+ * @pre              ApproxWordCounter must be initialized
+ *
+ * @post             Words from input stream are counted by this
+ *                   ApproxWordCounter
+ *
+ * @param   input    input to stream into this ApproxWordCounter
+ *
+ * @param   counter  reference to this ApproxWordCounter object
+ *
+ * @return           input stream
+ */
+std::istream& operator>>(std::istream& input,
+   ApproxWordCounter& counter);
+// end ApproxWordCounter.h
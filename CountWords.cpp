@@ -9,14 +9,75 @@
  * 2020-12-07
  */
 
+#include <climits>
+#include <cstdlib>
 #include <iostream>
+#include <string>
+#include "ApproxWordCounter.h"
 #include "WordTree.h"
 
 /**
- * Entry point for this program.
+ * Counts words approximately in fixed memory and outputs the most
+ * frequent words along with the error bounds of their counts.
+ *
+ * @param   numHitters   number of most frequent words to output
+ */
+void countApproximately(int numHitters) {
+   ApproxWordCounter counter(4096, 4, numHitters);
+   std::cin >> counter;
+   std::cout << counter;
+   std::cout << std::endl;
+   std::cout << std::endl;
+   std::cout << "total number of tokens counted : "
+      << counter.numWords() << std::endl;
+   std::cout << "counts overestimate by at most "
+      << counter.errorBound() << " with probability "
+      << 1 - counter.failureProbability() << std::endl;
+}
+
+/**
+ * Outputs how to run this program to the error stream.
+ *
+ * @param   program   name this program was run as
+ */
+void printUsage(const char* program) {
+   std::cerr << "usage: " << program
+      << " [--adaptive | --approx [number of words]]\n"
+      << "number of words must be a positive integer" << std::endl;
+}
+
+/**
+ * Entry point for this program. Counts every word exactly with a
+ * WordTree, which keeps frequent words near its root when run with
+ * --adaptive. When run with --approx [number of words], counts only
+ * the most frequent words approximately. Any other arguments print
+ * the usage and exit with status 1.
  */ 
-int main() {
-   WordTree wordTree;
+int main(int argc, char* argv[]) {
+   std::string option = argc > 1 ? argv[1] : "";
+
+   if (option == "--approx" && argc <= 3) {
+      long numHitters = 100;
+      if (argc > 2) {
+         char* end = nullptr;
+         numHitters = std::strtol(argv[2], &end, 10);
+         if (end == argv[2] || *end != '\0' || numHitters <= 0 ||
+            numHitters > INT_MAX) {
+            printUsage(argv[0]);
+            return 1;
+         }
+      }
+      countApproximately(static_cast<int>(numHitters));
+      return 0;
+   }
+
+   if (argc > 2 || (argc == 2 && option != "--adaptive")) {
+      printUsage(argv[0]);
+      return 1;
+   }
+
+   WordTree wordTree(option == "--adaptive" ?
+      WordTree::TreeMode::FrequencyAdaptive : WordTree::TreeMode::Plain);
    std::cin >> wordTree;
    std::cout << wordTree;
    std::cout << std::endl;
@@ -0,0 +1,292 @@
+/**
+ * PackedWordTree.cpp
+ *
+ * Implementations for the PackedWordTree class and nested struct
+ * PackedNode. The PackedWordTree class is a binary search tree of
+ * words like WordTree, but its nodes are packed into a single
+ * vector and address each other with 32-bit indices. Each node keeps
+ * the first 8 bytes of its word as an integer, so most comparisons
+ * are a single integer comparison, and only the rest of longer words
+ * is stored in a shared character pool.
+ *
+ * Joshua Scheck
+ * 2026-10-18
+ */
+
+#include "PackedWordTree.h"
+#include "WordTokenizer.h"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <stdexcept>
+
+/** number of bytes of a word that are packed into its prefix */
+static const std::size_t PREFIX_LENGTH = sizeof(std::uint64_t);
+
+/**
+ * Default constructor for PackedWordTree class, which initializes
+ * an empty PackedWordTree
+ */
+PackedWordTree::PackedWordTree() {}
+
+/**
+ * Adds the provided word as a PackedNode to this PackedWordTree,
+ * folding it to lower case like WordTree::add
+ *
+ * @pre              PackedWordTree must be initialized
+ *
+ * @post             If anEntry does not exist in this
+ *                   PackedWordTree, a new PackedNode is added.
+ *                   Otherwise the PackedNode containing anEntry
+ *                   will have it's count increase by 1.
+ *
+ * @param   anEntry  word to add to this PackedWordTree
+ *
+ * @throws  std::length_error if a new word would not fit in the
+ *          32-bit node indices or character pool offsets
+ */
+void PackedWordTree::add(std::string anEntry) {
+   // make string lower case
+   for (char& currChar : anEntry) {
+      currChar = std::tolower(currChar);
+   }
+
+   insert(anEntry);
+}
+
+/**
+ * Adds the provided word as a PackedNode to this PackedWordTree
+ * exactly as it is given, without folding it to lower case
+ *
+ * @pre              PackedWordTree must be initialized
+ *
+ * @post             If aWord does not exist in this
+ *                   PackedWordTree, a new PackedNode is added.
+ *                   Otherwise the PackedNode containing aWord
+ *                   will have it's count increase by 1.
+ *
+ * @param   aWord    word to add to this PackedWordTree
+ *
+ * @throws  std::length_error if a new word would not fit in the
+ *          32-bit node indices or character pool offsets
+ */
+void PackedWordTree::insert(const std::string& aWord) {
+   std::uint64_t prefix = packPrefix(aWord);
+
+   // walk down from the root, remembering which child index of the
+   // parent a new PackedNode has to be linked into
+   std::uint32_t* link = nullptr;
+   std::uint32_t currNode = nodes.empty() ? NO_NODE : 0;
+
+   while (currNode != NO_NODE) {
+      PackedNode& node = nodes[currNode];
+      int order = compare(node, aWord, prefix);
+
+      if (order == 0) {
+         node.count++;
+         return;
+      }
+
+      link = order < 0 ? &node.left : &node.right;
+      currNode = *link;
+   }
+
+   // index NO_NODE is reserved, and the offset and length of the
+   // word's suffix must fit in 32 bits
+   std::size_t suffixLength = aWord.size() > PREFIX_LENGTH ?
+      aWord.size() - PREFIX_LENGTH : 0;
+   if (nodes.size() >= NO_NODE || aWord.size() > UINT32_MAX ||
+      suffixes.size() > UINT32_MAX - suffixLength) {
+      throw std::length_error("PackedWordTree is full");
+   }
+
+   PackedNode node;
+   node.prefix = prefix;
+   node.suffix = static_cast<std::uint32_t>(suffixes.size());
+   node.length = static_cast<std::uint32_t>(aWord.size());
+   node.count = 1;
+   node.left = NO_NODE;
+   node.right = NO_NODE;
+
+   if (suffixLength > 0) {
+      suffixes.insert(suffixes.end(), aWord.begin() + PREFIX_LENGTH,
+         aWord.end());
+   }
+
+   // link before push_back, which may move the PackedNodes
+   if (link != nullptr) {
+      *link = static_cast<std::uint32_t>(nodes.size());
+   }
+   nodes.push_back(node);
+}
+
+/**
+ * Retrieves the current number of PackedNodes that exists in
+ * this PackedWordTree.
+ *
+ * @post    state of this PackedWordTree does not change
+ *
+ * @return  total number of PackedNodes
+ */
+int PackedWordTree::numWords() const {
+   return static_cast<int>(nodes.size());
+}
+
+/**
+ * Private helper method that packs the first 8 bytes of the
+ * provided word into an integer that orders like the word. Bytes
+ * are packed most significant first and missing bytes are zeros.
+ *
+ * @param   aWord    word to pack
+ *
+ * @return           packed prefix of aWord
+ */
+std::uint64_t PackedWordTree::packPrefix(const std::string& aWord) {
+   std::uint64_t prefix = 0;
+   std::size_t length = std::min(aWord.size(), PREFIX_LENGTH);
+
+   for (std::size_t idx = 0; idx < PREFIX_LENGTH; idx++) {
+      prefix <<= 8;
+      if (idx < length) {
+         prefix |= static_cast<unsigned char>(aWord[idx]);
+      }
+   }
+
+   return prefix;
+}
+
+/**
+ * Private helper method that compares the provided word against
+ * the word stored in the provided PackedNode, comparing the packed
+ * prefixes first and only then the rest of the words. Orders words
+ * the same way as std::string::compare.
+ *
+ * @param   node     PackedNode to compare against
+ * @param   aWord    word to compare
+ * @param   prefix   packed prefix of aWord
+ *
+ * @return           negative, zero or positive when aWord orders
+ *                   before, equal to or after the word in node
+ */
+int PackedWordTree::compare(const PackedNode& node,
+   const std::string& aWord, std::uint64_t prefix) const {
+
+   if (prefix != node.prefix) {
+      return prefix < node.prefix ? -1 : 1;
+   }
+
+   // with equal prefixes, a word of at most 8 bytes is the start of
+   // the other word, so the shorter word orders first
+   if (aWord.size() > PREFIX_LENGTH && node.length > PREFIX_LENGTH) {
+      std::size_t length = std::min<std::size_t>(aWord.size(),
+         node.length) - PREFIX_LENGTH;
+      int order = std::memcmp(aWord.data() + PREFIX_LENGTH,
+         suffixes.data() + node.suffix, length);
+      if (order != 0) {
+         return order;
+      }
+   }
+
+   if (aWord.size() != node.length) {
+      return aWord.size() < node.length ? -1 : 1;
+   }
+   return 0;
+}
+
+/**
+ * Private helper method that rebuilds the word stored in the
+ * provided PackedNode
+ *
+ * @param   node     PackedNode to rebuild the word of
+ *
+ * @return           word stored in node
+ */
+std::string PackedWordTree::word(const PackedNode& node) const {
+   std::string aWord;
+   aWord.reserve(node.length);
+
+   for (std::size_t idx = 0; idx < node.length; idx++) {
+      if (idx < PREFIX_LENGTH) {
+         int shift = 8 * static_cast<int>(PREFIX_LENGTH - 1 - idx);
+         aWord.push_back(static_cast<char>(node.prefix >> shift));
+      }
+      else {
+         aWord.push_back(suffixes[node.suffix + idx - PREFIX_LENGTH]);
+      }
+   }
+
+   return aWord;
+}
+
+/**
+ * Private helper method that leverages recursive in-order
+ * traversals to print items and counts from the current
+ * PackedNode.
+ *
+ * @param   currNode index of the current PackedNode
+ * @param   output   Reference to output stream
+ */
+void PackedWordTree::printWords(std::uint32_t currNode,
+   std::ostream& output) const {
+
+   if (currNode == NO_NODE) {
+      return;
+   }
+
+   const PackedNode& node = nodes[currNode];
+   printWords(node.left, output);
+   output << word(node) << " " << node.count << "\n";
+   printWords(node.right, output);
+}
+
+/**
+ * Overloads the output stream operator for use with PackedWordTree
+ * objects. Allows for outputting the values of this PackedWordTree
+ * into the output stream, in the same format as WordTree.
+ *
+ * Calls the private recursive helper method
+ * printWords(std::uint32_t currNode, std::ostream& output) to
+ * leverage recursive in-order traversals to print PackedNode values
+ *
+ * @pre              PackedWordTree must be initialized
+ *
+ * @post             value of this PackedWordTree is sent to output
+ *                   stream
+ *
+ * @param   output   output to stream this PackedWordTree to
+ *
+ * @param   wordTree this PackedWordTree object
+ *
+ * @return           output stream
+ */
+std::ostream& operator<<(std::ostream& output,
+   const PackedWordTree& wordTree) {
+
+   if (!wordTree.nodes.empty()) {
+      wordTree.printWords(0, output);
+   }
+   return output;
+}
+
+/**
+ * Overloads the input stream operator for use with PackedWordTree
+ * objects. Allows for input stream to stream words into this
+ * PackedWordTree.
+ *
+ * Words are read with WordTokenizer<DefaultWordPolicy>, the same
+ * word rules used by WordTree
+ *
+ * @pre              PackedWordTree must be initialized
+ *
+ * @post             Values from input stream are inputted into this
+ *                   PackedWordTree
+ *
+ * @param   input    input to stream into this PackedWordTree
+ *
+ * @param   wordTree reference to this PackedWordTree object
+ *
+ * @return           input stream
+ */
+std::istream& operator>>(std::istream& input, PackedWordTree& wordTree) {
+   return WordTokenizer<DefaultWordPolicy>::read(input, wordTree);
+} // end PackedWordTree.cpp
@@ -0,0 +1,227 @@
+/**
+ * PackedWordTree.h
+ *
+ * Declarations for the PackedWordTree class and nested struct
+ * PackedNode. The PackedWordTree class is a binary search tree of
+ * words like WordTree, but its nodes are packed into a single
+ * vector and address each other with 32-bit indices. Each node keeps
+ * the first 8 bytes of its word as an integer, so most comparisons
+ * are a single integer comparison, and only the rest of longer words
+ * is stored in a shared character pool.
+ *
+ * Because of the 32-bit indices, a PackedWordTree holds fewer than
+ * 2^32 - 1 unique words, and the character pool holds at most
+ * 2^32 - 1 bytes. Adding a word past either limit throws
+ * std::length_error.
+ *
+ * Joshua Scheck
+ * 2026-10-18
+ */
+
+#pragma once
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+class PackedWordTree {
+
+/**
+ * Overloads the output stream operator for use with PackedWordTree
+ * objects. Allows for outputting the values of this PackedWordTree
+ * into the output stream, in the same format as WordTree.
+ *
+ * Calls the private recursive helper method
+ * printWords(std::uint32_t currNode, std::ostream& output) to
+ * leverage recursive in-order traversals to print PackedNode values
+ *
+ * @pre              PackedWordTree must be initialized
+ *
+ * @post             value of this PackedWordTree is sent to output
+ *                   stream
+ *
+ * @param   output   output to stream this PackedWordTree to
+ *
+ * @param   wordTree this PackedWordTree object
+ *
+ * @return           output stream
+ */
+friend std::ostream& operator<<(std::ostream& output,
+   const PackedWordTree& wordTree);
+
+public:
+
+   /**
+    * Default constructor for PackedWordTree class, which initializes
+    * an empty PackedWordTree
+    */
+   PackedWordTree();
+
+   /**
+    * PackedNode structure which represents nodes that compose this
+    * PackedWordTree
+    */
+   struct PackedNode {
+
+      /** First 8 bytes of the stored word, most significant byte
+       * first and padded with zeros */
+      std::uint64_t prefix;
+      /** Index into suffixes of the bytes of the stored word after
+       * the first 8 */
+      std::uint32_t suffix;
+      /** Length of the stored word */
+      std::uint32_t length;
+      /** Frequency, in which the stored word in this PackedNode is
+       * encountered */
+      std::uint32_t count;
+      /** index of the left PackedNode for this PackedNode */
+      std::uint32_t left;
+      /** index of the right PackedNode for this PackedNode */
+      std::uint32_t right;
+   };
+
+   /**
+    * Adds the provided word as a PackedNode to this PackedWordTree,
+    * folding it to lower case like WordTree::add
+    *
+    * @pre              PackedWordTree must be initialized
+    *
+    * @post             If anEntry does not exist in this
+    *                   PackedWordTree, a new PackedNode is added.
+    *                   Otherwise the PackedNode containing anEntry
+    *                   will have it's count increase by 1.
+    *
+    * @param   anEntry  word to add to this PackedWordTree
+    *
+    * @throws  std::length_error if a new word would not fit in the
+    *          32-bit node indices or character pool offsets
+    */
+   void add(std::string anEntry);
+
+   /**
+    * Adds the provided word as a PackedNode to this PackedWordTree
+    * exactly as it is given, without folding it to lower case
+    *
+    * @pre              PackedWordTree must be initialized
+    *
+    * @post             If aWord does not exist in this
+    *                   PackedWordTree, a new PackedNode is added.
+    *                   Otherwise the PackedNode containing aWord
+    *                   will have it's count increase by 1.
+    *
+    * @param   aWord    word to add to this PackedWordTree
+    *
+    * @throws  std::length_error if a new word would not fit in the
+    *          32-bit node indices or character pool offsets
+    */
+   void insert(const std::string& aWord);
+
+   /**
+    * Retrieves the current number of PackedNodes that exists in
+    * this PackedWordTree.
+    *
+    * @post    state of this PackedWordTree does not change
+    *
+    * @return  total number of PackedNodes
+    */
+   int numWords() const;
+
+private:
+   /**
+    * Private helper method that packs the first 8 bytes of the
+    * provided word into an integer that orders like the word
+    *
+    * @param   aWord    word to pack
+    *
+    * @return           packed prefix of aWord
+    */
+   static std::uint64_t packPrefix(const std::string& aWord);
+
+   /**
+    * Private helper method that compares the provided word against
+    * the word stored in the provided PackedNode, comparing the packed
+    * prefixes first and only then the rest of the words
+    *
+    * @param   node     PackedNode to compare against
+    * @param   aWord    word to compare
+    * @param   prefix   packed prefix of aWord
+    *
+    * @return           negative, zero or positive when aWord orders
+    *                   before, equal to or after the word in node
+    */
+   int compare(const PackedNode& node, const std::string& aWord,
+      std::uint64_t prefix) const;
+
+   /**
+    * Private helper method that rebuilds the word stored in the
+    * provided PackedNode
+    *
+    * @param   node     PackedNode to rebuild the word of
+    *
+    * @return           word stored in node
+    */
+   std::string word(const PackedNode& node) const;
+
+   /**
+    * Private helper method that leverages recursive in-order
+    * traversals to print items and counts from the current
+    * PackedNode.
+    *
+    * @param   currNode index of the current PackedNode
+    * @param   output   Reference to output stream
+    */
+   void printWords(std::uint32_t currNode, std::ostream& output) const;
+
+   /** index used in place of a missing PackedNode */
+   static const std::uint32_t NO_NODE = UINT32_MAX;
+
+   /** all PackedNodes of this PackedWordTree, the root is first */
+   std::vector<PackedNode> nodes;
+   /** bytes of stored words after their first 8 bytes */
+   std::vector<char> suffixes;
+};
+
+/**
+ * Overloads the output stream operator for use with PackedWordTree
+ * objects. Allows for outputting the values of this PackedWordTree
+ * into the output stream, in the same format as WordTree.
+ *
+ * Calls the private recursive helper method
+ * printWords(std::uint32_t currNode, std::ostream& output) to
+ * leverage recursive in-order traversals to print PackedNode values
+ *
+ * @pre              PackedWordTree must be initialized
+ *
+ * @post             value of this PackedWordTree is sent to output
+ *                   stream
+ *
+ * @param   output   output to stream this PackedWordTree to
+ *
+ * @param   wordTree this PackedWordTree object
+ *
+ * @return           output stream
+ */
+std::ostream& operator<<(std::ostream& output,
+   const PackedWordTree& wordTree);
+
+/**
+ * Overloads the input stream operator for use with PackedWordTree
+ * objects. Allows for input stream to stream words into this
+ * PackedWordTree.
+ *
+ * Words are read with WordTokenizer<DefaultWordPolicy>, the same
+ * word rules used by WordTree
+ *
+ * @pre              PackedWordTree must be initialized
+ *
+ * @post             Values from input stream are inputted into this
+ *                   PackedWordTree
+ *
+ * @param   input    input to stream into this PackedWordTree
+ *
+ * @param   wordTree reference to this PackedWordTree object
+ *
+ * @return           input stream
+ */
+std::istream& operator>>(std::istream& input, PackedWordTree& wordTree);
+// end PackedWordTree.h
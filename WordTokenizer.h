@@ -0,0 +1,244 @@
+/**
+ * WordTokenizer.h
+ *
+ * Declarations and implementations for the WordTokenizer class
+ * template and the word policies it is parameterized by. A word
+ * policy describes, at compile time, how characters from an input
+ * stream are turned into words (case folding, apostrophe handling,
+ * digit handling, minimum length and stopword filtering). The
+ * WordTokenizer builds constexpr lookup tables from the policy so
+ * each configuration compiles to its own specialized loop.
+ *
+ * Joshua Scheck
+ * 2026-10-18
+ */
+
+#pragma once
+#include <cstddef>
+#include <istream>
+#include <iterator>
+#include <string>
+
+/**
+ * How digits that appear in the input stream are treated
+ */
+enum class DigitRule {
+   /** A digit ends the current word, like any other punctuation */
+   Split,
+   /** A word that contains a digit is thrown away entirely */
+   Discard,
+   /** Digits are word characters, just like letters */
+   Keep
+};
+
+/**
+ * How single quotation marks that appear in the input stream are
+ * treated
+ */
+enum class ApostropheRule {
+   /** A single quotation mark ends the current word */
+   Split,
+   /** Single quotation marks are kept inside of a word, but are
+    * dropped from the start of a word and a single one is dropped
+    * from the end of a word */
+   Inner,
+   /** Single quotation marks are always kept as word characters */
+   Keep
+};
+
+/**
+ * Word policy which reproduces the original WordTree word rules:
+ * words are folded to lower case, digits and punctuation end a word,
+ * and single quotation marks are only kept inside of a word.
+ *
+ * Custom policies may derive from this struct and shadow any of its
+ * members.
+ */
+struct DefaultWordPolicy {
+   /** Whether upper case letters are folded to lower case */
+   static constexpr bool foldCase = true;
+   /** Treatment of single quotation marks */
+   static constexpr ApostropheRule apostrophes = ApostropheRule::Inner;
+   /** Treatment of digits */
+   static constexpr DigitRule digits = DigitRule::Split;
+   /** Words shorter than this number of characters are skipped */
+   static constexpr std::size_t minLength = 1;
+   /** Whether isStopword(const std::string& word) is consulted */
+   static constexpr bool filterStopwords = false;
+
+   /**
+    * Checks whether the provided word should be skipped. Only
+    * called when filterStopwords is true.
+    *
+    * @param   word  folded word that is about to be added
+    *
+    * @return        true if the word should be skipped
+    */
+   static bool isStopword(const std::string&) {
+      return false;
+   }
+};
+
+/**
+ * WordTokenizer reads words from an input stream according to the
+ * rules of the provided Policy and hands every word to a sink, which
+ * is any object with an insert(const std::string& aWord) method.
+ */
+template <typename Policy = DefaultWordPolicy>
+class WordTokenizer {
+public:
+
+   /**
+    * Reads every word out of the provided input stream and inserts
+    * it into the provided sink.
+    *
+    * @pre              sink must be initialized
+    *
+    * @post             Every word from the input stream that
+    *                   passes the Policy has been inserted into the
+    *                   sink, and the input stream is at its end
+    *
+    * @param   input    input stream to read words from
+    * @param   sink     object that words are inserted into
+    *
+    * @return           input stream
+    */
+   template <typename Sink>
+   static std::istream& read(std::istream& input, Sink& sink) {
+      const CharTable& table = charTable();
+      std::istreambuf_iterator<char> curr(input);
+      std::istreambuf_iterator<char> end;
+
+      std::string word;
+      // set once a digit is seen under DigitRule::Discard
+      bool discard = false;
+
+      for (; curr != end; ++curr) {
+         unsigned char currChar = static_cast<unsigned char>(*curr);
+
+         switch (table.kind[currChar]) {
+            case Letter:
+               word.push_back(table.fold[currChar]);
+               break;
+            case Apostrophe:
+               // a leading single quotation mark is only kept when
+               // the policy keeps every single quotation mark
+               if (!word.empty() ||
+                  Policy::apostrophes == ApostropheRule::Keep) {
+                  word.push_back(static_cast<char>(currChar));
+               }
+               break;
+            case Digit:
+               discard = true;
+               break;
+            case Separator:
+               if (!word.empty()) {
+                  flush(word, discard, sink);
+               }
+               discard = false;
+               break;
+         }
+      }
+
+      // add any left over words if any
+      if (!word.empty()) {
+         flush(word, discard, sink);
+      }
+
+      input.setstate(std::ios::eofbit | std::ios::failbit);
+      return input;
+   }
+
+private:
+
+   /** Kinds of characters, as classified by the Policy */
+   enum CharKind : unsigned char {
+      Separator,
+      Letter,
+      Apostrophe,
+      Digit
+   };
+
+   /**
+    * Lookup tables indexed by character, holding the kind of each
+    * character and its folded form
+    */
+   struct CharTable {
+      /** kind of each character */
+      CharKind kind[256];
+      /** folded form of each character */
+      char fold[256];
+   };
+
+   /**
+    * Builds the lookup tables for the Policy at compile time
+    *
+    * @return  lookup tables for the Policy
+    */
+   static constexpr CharTable makeCharTable() {
+      CharTable table = {};
+
+      for (int idx = 0; idx < 256; idx++) {
+         bool upper = idx >= 'A' && idx <= 'Z';
+         bool lower = idx >= 'a' && idx <= 'z';
+         bool digit = idx >= '0' && idx <= '9';
+
+         table.fold[idx] = static_cast<char>(
+            upper && Policy::foldCase ? idx - 'A' + 'a' : idx);
+
+         if (upper || lower) {
+            table.kind[idx] = Letter;
+         }
+         else if (digit && Policy::digits == DigitRule::Keep) {
+            table.kind[idx] = Letter;
+         }
+         else if (digit && Policy::digits == DigitRule::Discard) {
+            table.kind[idx] = Digit;
+         }
+         else if (idx == '\'' &&
+            Policy::apostrophes != ApostropheRule::Split) {
+            table.kind[idx] = Apostrophe;
+         }
+         else {
+            table.kind[idx] = Separator;
+         }
+      }
+
+      return table;
+   }
+
+   /**
+    * Retrieves the lookup tables for the Policy
+    *
+    * @return  lookup tables for the Policy
+    */
+   static const CharTable& charTable() {
+      static constexpr CharTable table = makeCharTable();
+      return table;
+   }
+
+   /**
+    * Finishes the current word, inserting it into the sink if it
+    * passes the Policy, and clears it.
+    *
+    * @param   word     current word, cleared on return
+    * @param   discard  whether the current word contained a digit
+    *                   under DigitRule::Discard
+    * @param   sink     object that the word is inserted into
+    */
+   template <typename Sink>
+   static void flush(std::string& word, bool discard, Sink& sink) {
+      if (Policy::apostrophes == ApostropheRule::Inner &&
+         word.size() > 1 && word.back() == '\'') {
+         word.pop_back();
+      }
+
+      if (!discard && word.size() >= Policy::minLength &&
+         !(Policy::filterStopwords && Policy::isStopword(word))) {
+         sink.insert(word);
+      }
+
+      word.clear();
+   }
+};
+// end WordTokenizer.h
@@ -11,14 +11,24 @@
  */
 
 #include "WordTree.h"
+#include "WordTokenizer.h"
+#include <functional>
 #include <string>
-#include <vector>
 
 /**
  * Default constructor for WordTree class, which initializes an 
- * empty WordTree
+ * empty WordTree in TreeMode::Plain
  */
-WordTree::WordTree() : root(nullptr) {}
+WordTree::WordTree() : WordTree(TreeMode::Plain) {}
+
+/**
+ * Constructor for WordTree class, which initializes an empty
+ * WordTree that arranges its WordNodes according to mode
+ *
+ * @param   mode     way in which WordNodes are arranged
+ */
+WordTree::WordTree(TreeMode mode) : root(nullptr), mode(mode),
+   numAdded(0), totalDepth(0) {}
 
 /**
  * Destructor, which will to sequentially deallocate memory from
@@ -47,7 +57,9 @@ WordTree::~WordTree() {
  *                         be deep copied to this WordTree
  *
  */
-WordTree::WordTree(const WordTree& otherWordTree) {
+WordTree::WordTree(const WordTree& otherWordTree) :
+   mode(otherWordTree.mode), numAdded(otherWordTree.numAdded),
+   totalDepth(otherWordTree.totalDepth) {
    if(otherWordTree.root == nullptr) {
       root = nullptr;
    }
@@ -79,7 +91,29 @@ void WordTree::add(std::string anEntry) {
       anEntry[idx] = std::tolower(anEntry[idx]);
    }
 
-   root = add(root, anEntry);
+   insert(anEntry);
+}
+
+/**
+ * Adds the provided word as a WordNode to this WordTree exactly
+ * as it is given, without folding it to lower case. Used by
+ * WordTokenizer, which has already folded the word according to
+ * its word policy.
+ *
+ * @pre              WordTree must be initialized, which will also
+ *                   initialize class data member root
+ *
+ * @post             If aWord does not exist in this WordTree, a
+ *                   new Node is added to this WordTree. If aWord
+ *                   is already in this WordTree then the WordNode
+ *                   containing aWord will have it's count
+ *                   increase by 1.
+ *
+ * @param   aWord    word to add to this WordTree
+ */
+void WordTree::insert(const std::string& aWord) {
+   numAdded++;
+   root = add(root, aWord);
 }
 
 /**
@@ -100,6 +134,21 @@ int WordTree::numWords() const {
     return numWords(root);
 }
 
+/**
+ * Retrieves the average number of WordNodes compared against
+ * by each add or insert so far.
+ *
+ * @post    state of this WordTree does not change
+ *
+ * @return  average depth per added word, 0 if none were added
+ */
+double WordTree::averageDepth() const {
+   if (numAdded == 0) {
+      return 0;
+   }
+   return static_cast<double>(totalDepth) / numAdded;
+}
+
 /**
  * Private helper method that recursively checks anEntry against
  * item of the provided root and adds the anEntry accordingly.
@@ -112,6 +161,9 @@ int WordTree::numWords() const {
  *                   item. Otherwise recursively adds to the 
  *                   left if less than the item or to the
  *                   right if more than the item.
+ *                   In TreeMode::FrequencyAdaptive, rotates the
+ *                   child it added to above currNode if the child
+ *                   ranks above it.
  * 
  * @param   currNode Reference to the current WordNode
  * @param   anEntry  New word to compare against the item of
@@ -120,32 +172,97 @@ int WordTree::numWords() const {
  * @return           Resulting current WordNode
  */
 WordTree::WordNode* WordTree::add(WordNode* currNode, 
-   std::string anEntry) {
+   const std::string& anEntry) {
 
    if (currNode == nullptr) {
       WordNode* currNode = new WordNode;
       currNode->item = anEntry;
       currNode->count = 1;
+      // priority is only read in TreeMode::FrequencyAdaptive
+      currNode->priority = mode == TreeMode::FrequencyAdaptive ?
+         static_cast<unsigned int>(std::hash<std::string>()(anEntry)) :
+         0;
       currNode->left = nullptr;
       currNode->right = nullptr;
       return currNode;
    }
 
-   std::string rootWord = currNode->item;
+   totalDepth++;
+   int order = currNode->item.compare(anEntry);
 
-   if (rootWord.compare(anEntry) < 0) {
+   if (order < 0) {
       currNode->right = add(currNode->right, anEntry);
+      if (mode == TreeMode::FrequencyAdaptive &&
+         ranksAbove(currNode->right, currNode)) {
+         currNode = rotateLeft(currNode);
+      }
    }
-   else if (rootWord.compare(anEntry) > 0) {
+   else if (order > 0) {
       currNode->left = add(currNode->left, anEntry);
+      if (mode == TreeMode::FrequencyAdaptive &&
+         ranksAbove(currNode->left, currNode)) {
+         currNode = rotateRight(currNode);
+      }
    } 
-   else if (rootWord.compare(anEntry) == 0) {
+   else {
       (currNode->count)++;
    }
 
    return currNode;
 }
 
+/**
+ * Private helper method that rotates the left WordNode of the
+ * provided WordNode up into its place.
+ *
+ * @param   currNode Reference to the current WordNode, which
+ *                   must have a left WordNode
+ *
+ * @return           WordNode now in place of currNode
+ */
+WordTree::WordNode* WordTree::rotateRight(WordNode* currNode) {
+   WordNode* child = currNode->left;
+   currNode->left = child->right;
+   child->right = currNode;
+   return child;
+}
+
+/**
+ * Private helper method that rotates the right WordNode of the
+ * provided WordNode up into its place.
+ *
+ * @param   currNode Reference to the current WordNode, which
+ *                   must have a right WordNode
+ *
+ * @return           WordNode now in place of currNode
+ */
+WordTree::WordNode* WordTree::rotateLeft(WordNode* currNode) {
+   WordNode* child = currNode->right;
+   currNode->right = child->left;
+   child->left = currNode;
+   return child;
+}
+
+/**
+ * Private helper method that checks whether the provided child
+ * WordNode belongs above its parent in
+ * TreeMode::FrequencyAdaptive.
+ *
+ * @param   child    Reference to the child WordNode
+ * @param   parent   Reference to the parent WordNode
+ *
+ * @return           true if child is more frequent than parent,
+ *                   or equally frequent with a higher priority
+ */
+bool WordTree::ranksAbove(const WordNode* child,
+   const WordNode* parent) const {
+
+   if (child->count != parent->count) {
+      return child->count > parent->count;
+   }
+   return child->priority > parent->priority;
+}
+
 /**
  * Private helper method that leverages recursive post-order
  * traversals to remove WordNodes that exists in this WordTree.
@@ -250,6 +367,7 @@ WordTree::WordNode* WordTree::copyTree(WordNode* currNode) const {
    WordNode* temp = new WordNode;
    temp->item = currNode->item;
    temp->count = currNode->count;
+   temp->priority = currNode->priority;
    temp->left = copyTree(currNode->left);
    temp->right = copyTree(currNode->right);
    return temp;
@@ -284,6 +402,9 @@ std::ostream& operator<<(std::ostream& output, WordTree wordTree) {
  * objects. Allows for input stream to stream words into this
  * WordTree. 
  *
+ * Words are read with WordTokenizer<DefaultWordPolicy>, use
+ * WordTokenizer with a different word policy for other word rules
+ *
  * @pre              WordTree must be initialized with root WordNode
  *
  * @post             Values from input stream are inputted into this
@@ -296,48 +417,5 @@ std::ostream& operator<<(std::ostream& output, WordTree wordTree) {
  * @return           input stream
  */
 std::istream& operator>>(std::istream& input, WordTree& wordTree) {
-   // skips any white space at the beginning of input stream
-   input >> std::skipws;
-   // vector containing chars that will be used as the word to
-   // add to WordTree
-   std::vector<char> wordVector;
-   
-   char currChar;
-   while (input.get(currChar)) {
-
-      // white space or a non single quotation mark special character
-      // paired with a non empty char vector signals that a word
-      // needs to be added
-      if (wordVector.size() > 0 && (isspace(currChar) || 
-         (!isalpha(currChar) && currChar !='\''))) {
-         
-         if (wordVector.size() > 1 && wordVector.back() =='\'') {
-            wordVector.pop_back();
-         }
-         std::string word(wordVector.begin(), wordVector.end());
-         wordTree.add(word);
-         wordVector.clear();
-      }
-      // if word contains any numbers then assume its not a word and
-      // clear whole character vector
-      else if (isdigit(currChar)) {
-         wordVector.clear();
-      }
-      // only add characters if alphabetical or if the current
-      // character is an single quotation mark and is not the first
-      // char in the word
-      else if (isalpha(currChar) || (currChar =='\'' && 
-         wordVector.size() > 0)) {
-         wordVector.push_back(currChar);
-      }
-   }
-
-   // add any left over words if any
-   if (wordVector.size() > 0) {
-      std::string word(wordVector.begin(), wordVector.end());
-      wordTree.add(word);
-      wordVector.clear();
-   }
-
-   return input;
+   return WordTokenizer<DefaultWordPolicy>::read(input, wordTree);
 } // end WordTree.cpp
\ No newline at end of file
@@ -43,6 +43,9 @@ friend std::ostream& operator<<(std::ostream& output,
  * objects. Allows for input stream to stream words into this
  * WordTree. 
  *
+ * Words are read with WordTokenizer<DefaultWordPolicy>, use
+ * WordTokenizer with a different word policy for other word rules
+ *
  * @pre              WordTree must be initialized with root WordNode
  *
  * @post             Values from input stream are inputted into this
@@ -59,12 +62,32 @@ friend std::istream& operator>>(std::istream& input,
 
 public:
 
+   /**
+    * Ways in which a WordTree arranges its WordNodes
+    */
+   enum class TreeMode {
+      /** WordNodes stay where insertion order left them */
+      Plain,
+      /** WordNodes are rotated so that more frequent words are
+       * closer to the root, with equally frequent words arranged
+       * as a treap on a hash of the word */
+      FrequencyAdaptive
+   };
+
    /**
     * Default constructor for WordTree class, which initializes an 
-    * empty WordTree
+    * empty WordTree in TreeMode::Plain
     */
    WordTree();
 
+   /**
+    * Constructor for WordTree class, which initializes an empty
+    * WordTree that arranges its WordNodes according to mode
+    *
+    * @param   mode     way in which WordNodes are arranged
+    */
+   explicit WordTree(TreeMode mode);
+
    /**
     * Destructor, which will to sequentially deallocate memory from
     * each WordNode existing in this WordTree. This destroys the 
@@ -101,6 +124,10 @@ public:
       /** Frequency, in which the stored word in this WordNode is
           * encountered */
       int count;
+      /** Tie breaker between equally frequent WordNodes in
+       * TreeMode::FrequencyAdaptive, a hash of the stored word, and
+       * 0 in TreeMode::Plain */
+      unsigned int priority;
       /** reference in memory to the left WordNode for this 
        * WordNode */
       WordNode* left;
@@ -128,6 +155,25 @@ public:
     */
    void add(std::string anEntry);
 
+   /**
+    * Adds the provided word as a WordNode to this WordTree exactly
+    * as it is given, without folding it to lower case. Used by
+    * WordTokenizer, which has already folded the word according to
+    * its word policy.
+    *
+    * @pre              WordTree must be initialized, which will also
+    *                   initialize class data member root
+    *
+    * @post             If aWord does not exist in this WordTree, a
+    *                   new Node is added to this WordTree. If aWord
+    *                   is already in this WordTree then the WordNode
+    *                   containing aWord will have it's count
+    *                   increase by 1.
+    *
+    * @param   aWord    word to add to this WordTree
+    */
+   void insert(const std::string& aWord);
+
    /**
     * Retrieves the current number of WordNodes that exists in this
     * wordTree.
@@ -144,6 +190,16 @@ public:
     */
    int numWords() const;
 
+   /**
+    * Retrieves the average number of WordNodes compared against
+    * by each add or insert so far.
+    *
+    * @post    state of this WordTree does not change
+    *
+    * @return  average depth per added word, 0 if none were added
+    */
+   double averageDepth() const;
+
 private:
    /**
     * Private helper method that recursively checks anEntry against
@@ -157,6 +213,9 @@ private:
     *                   item. Otherwise recursively adds to the 
     *                   left if less than the item or to the
     *                   right if more than the item.
+    *                   In TreeMode::FrequencyAdaptive, rotates the
+    *                   child it added to above currNode if the child
+    *                   ranks above it.
     * 
     * @param   currNode Reference to the current WordNode
     * @param   anEntry  New word to compare against the item of
@@ -164,7 +223,42 @@ private:
     * 
     * @return           Resulting current WordNode
     */ 
-   WordNode* add(WordNode* currNode, std::string anEntry);
+   WordNode* add(WordNode* currNode, const std::string& anEntry);
+
+   /**
+    * Private helper method that rotates the left WordNode of the
+    * provided WordNode up into its place.
+    *
+    * @param   currNode Reference to the current WordNode, which
+    *                   must have a left WordNode
+    *
+    * @return           WordNode now in place of currNode
+    */
+   WordNode* rotateRight(WordNode* currNode);
+
+   /**
+    * Private helper method that rotates the right WordNode of the
+    * provided WordNode up into its place.
+    *
+    * @param   currNode Reference to the current WordNode, which
+    *                   must have a right WordNode
+    *
+    * @return           WordNode now in place of currNode
+    */
+   WordNode* rotateLeft(WordNode* currNode);
+
+   /**
+    * Private helper method that checks whether the provided child
+    * WordNode belongs above its parent in
+    * TreeMode::FrequencyAdaptive.
+    *
+    * @param   child    Reference to the child WordNode
+    * @param   parent   Reference to the parent WordNode
+    *
+    * @return           true if child is more frequent than parent,
+    *                   or equally frequent with a higher priority
+    */
+   bool ranksAbove(const WordNode* child, const WordNode* parent) const;
 
    /**
     * Private helper method that leverages recursive post-order
@@ -237,6 +331,12 @@ private:
 
    /** reference in memory to the root WordNode in this WordTree */
    WordNode* root;
+   /** way in which WordNodes of this WordTree are arranged */
+   TreeMode mode;
+   /** number of words added to this WordTree */
+   long long numAdded;
+   /** total number of WordNodes visited while adding words */
+   long long totalDepth;
 };
 
 /**
@@ -265,6 +365,9 @@ std::ostream& operator<<(std::ostream& output, WordTree rhs);
  * objects. Allows for input stream to stream words into this
  * WordTree. 
  *
+ * Words are read with WordTokenizer<DefaultWordPolicy>, use
+ * WordTokenizer with a different word policy for other word rules
+ *
  * @pre              WordTree must be initialized with root WordNode
  *
  * @post             Values from input stream are inputted into this
@@ -0,0 +1,65 @@
+/**
+ * AllocationCounter.cpp
+ *
+ * Replacements for the global operator new and operator delete that
+ * count the heap bytes currently allocated, for WordTreeBench.cpp.
+ * They live in their own translation unit so they are never inlined
+ * into the code whose allocations they count.
+ *
+ * Joshua Scheck
+ * 2026-10-18
+ */
+
+#include "AllocationCounter.h"
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/** heap bytes currently allocated through operator new */
+static std::size_t currentBytes = 0;
+
+/**
+ * Counts heap bytes allocated through operator new. The size of each
+ * allocation is stored in front of it so operator delete can
+ * subtract it again.
+ */
+void* operator new(std::size_t size) {
+   std::size_t* block = static_cast<std::size_t*>(
+      std::malloc(size + sizeof(std::max_align_t)));
+   if (block == nullptr) {
+      throw std::bad_alloc();
+   }
+   *block = size;
+   currentBytes += size;
+   return reinterpret_cast<char*>(block) + sizeof(std::max_align_t);
+}
+
+/**
+ * Releases memory allocated by operator new(std::size_t size)
+ */
+void operator delete(void* memory) noexcept {
+   if (memory == nullptr) {
+      return;
+   }
+   std::size_t* block = reinterpret_cast<std::size_t*>(
+      static_cast<char*>(memory) - sizeof(std::max_align_t));
+   currentBytes -= *block;
+   std::free(block);
+}
+
+/**
+ * Releases memory allocated by operator new(std::size_t size)
+ */
+void operator delete(void* memory, std::size_t) noexcept {
+   operator delete(memory);
+}
+
+/**
+ * Retrieves the heap bytes currently allocated through operator new
+ *
+ * @return  heap bytes currently allocated
+ */
+std::size_t allocatedBytes() {
+   return currentBytes;
+}
+// end AllocationCounter.cpp
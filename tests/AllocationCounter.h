@@ -0,0 +1,22 @@
+/**
+ * AllocationCounter.h
+ *
+ * Declaration for allocatedBytes(), which reports the heap bytes
+ * counted by the operator new and operator delete replacements in
+ * AllocationCounter.cpp. Link AllocationCounter.cpp into a program to
+ * count its allocations.
+ *
+ * Joshua Scheck
+ * 2026-10-18
+ */
+
+#pragma once
+#include <cstddef>
+
+/**
+ * Retrieves the heap bytes currently allocated through operator new
+ *
+ * @return  heap bytes currently allocated
+ */
+std::size_t allocatedBytes();
+// end AllocationCounter.h
@@ -0,0 +1,93 @@
+/**
+ * TestWords.h
+ *
+ * Word fixtures shared by WordTreeTest.cpp and WordTreeBench.cpp:
+ * the text of rapunzel.txt, the exact counts held by a WordTree, and
+ * Zipf distributed words.
+ *
+ * Joshua Scheck
+ * 2026-10-18
+ */
+
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "WordTree.h"
+
+/**
+ * Reads the whole text of tests/rapunzel.txt, relative to the
+ * repository root
+ *
+ * @return  text of rapunzel.txt
+ */
+inline std::string readRapunzel() {
+   std::ifstream file("tests/rapunzel.txt");
+   assert(file);
+   std::stringstream text;
+   text << file.rdbuf();
+   return text.str();
+}
+
+/**
+ * Retrieves the exact count of every word in the provided WordTree
+ * by parsing its output
+ *
+ * @param   wordTree WordTree to retrieve the counts of
+ *
+ * @return           count of each word, in sorted word order
+ */
+inline std::map<std::string, long long> exactCounts(
+   const WordTree& wordTree) {
+
+   std::ostringstream output;
+   output << wordTree;
+
+   std::map<std::string, long long> counts;
+   std::istringstream input(output.str());
+   std::string word;
+   long long count;
+   while (input >> word >> count) {
+      counts[word] = count;
+   }
+   return counts;
+}
+
+/**
+ * Draws Zipf distributed words from the provided vocabulary, where
+ * the word at rank r (from 1) is drawn with probability
+ * proportional to 1 / r
+ *
+ * @param   vocabulary  words ordered from most to least frequent
+ * @param   numWords    number of words to draw
+ * @param   seed        seed of the random number generator
+ *
+ * @return              drawn words
+ */
+inline std::vector<std::string> zipfWords(
+   const std::vector<std::string>& vocabulary, int numWords,
+   unsigned long long seed) {
+
+   std::vector<double> cumulative;
+   double sum = 0;
+   for (std::size_t rank = 1; rank <= vocabulary.size(); rank++) {
+      sum += 1.0 / rank;
+      cumulative.push_back(sum);
+   }
+
+   std::vector<std::string> words;
+   unsigned long long state = seed;
+   for (int idx = 0; idx < numWords; idx++) {
+      state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+      double sample = (state >> 11) * (sum / 9007199254740992.0);
+      std::size_t rank = std::lower_bound(cumulative.begin(),
+         cumulative.end(), sample) - cumulative.begin();
+      words.push_back(vocabulary[std::min(rank, vocabulary.size() - 1)]);
+   }
+   return words;
+}
+// end TestWords.h
@@ -0,0 +1,307 @@
+/**
+ * WordTreeBench.cpp
+ *
+ * Benchmark for the WordTree and PackedWordTree classes. Reads text
+ * from standard input, then measures how fast WordTokenizer splits
+ * it into words compared with the tokenizer WordTree used before it,
+ * and measures the heap bytes used per unique
+ * word and the insert throughput of each tree, for the words of the
+ * text and for a synthetic vocabulary of random words. Also compares
+ * the average depth per added word of each WordTree::TreeMode with
+ * that of a perfectly balanced tree, for the text and for Zipf
+ * distributed words. Heap bytes are counted by AllocationCounter.cpp,
+ * which must be linked in.
+ *
+ * Joshua Scheck
+ * 2026-10-18
+ */
+
+#include <cctype>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "AllocationCounter.h"
+#include "PackedWordTree.h"
+#include "WordTokenizer.h"
+#include "WordTree.h"
+#include "TestWords.h"
+
+/**
+ * Sink for WordTokenizer that collects every word
+ */
+struct WordCollector {
+   std::vector<std::string> words;
+
+   void insert(const std::string& aWord) {
+      words.push_back(aWord);
+   }
+};
+
+/**
+ * Sink for WordTokenizer that only counts the words it is given, so
+ * that tokenizing is all that is timed
+ */
+struct WordCounter {
+   std::size_t numWords = 0;
+
+   void insert(const std::string&) {
+      numWords++;
+   }
+};
+
+/**
+ * Word policy that exercises every non-default rule: case is kept,
+ * words with digits are discarded, apostrophes split words, words
+ * shorter than 3 characters are skipped and so are "the" and "and"
+ */
+struct FilteredWordPolicy : DefaultWordPolicy {
+   static constexpr bool foldCase = false;
+   static constexpr ApostropheRule apostrophes = ApostropheRule::Split;
+   static constexpr DigitRule digits = DigitRule::Discard;
+   static constexpr std::size_t minLength = 3;
+   static constexpr bool filterStopwords = true;
+
+   static bool isStopword(const std::string& word) {
+      return word == "the" || word == "and";
+   }
+};
+
+/**
+ * Tokenizes the provided input with the word rules WordTree used
+ * before WordTokenizer: istream::get() into a vector of chars, with
+ * each word folded to lower case afterwards the way WordTree::add
+ * does. Kept as the baseline that WordTokenizer is compared against.
+ */
+void readLegacy(std::istream& input, WordCounter& sink) {
+   std::vector<char> wordVector;
+
+   char currChar;
+   while (input.get(currChar)) {
+      if (wordVector.size() > 0 && (isspace(currChar) ||
+         (!isalpha(currChar) && currChar !='\''))) {
+
+         if (wordVector.size() > 1 && wordVector.back() =='\'') {
+            wordVector.pop_back();
+         }
+         std::string word(wordVector.begin(), wordVector.end());
+         for (char& wordChar : word) {
+            wordChar = std::tolower(wordChar);
+         }
+         sink.insert(word);
+         wordVector.clear();
+      }
+      else if (isdigit(currChar)) {
+         wordVector.clear();
+      }
+      else if (isalpha(currChar) || (currChar =='\'' &&
+         wordVector.size() > 0)) {
+         wordVector.push_back(currChar);
+      }
+   }
+
+   if (wordVector.size() > 0) {
+      std::string word(wordVector.begin(), wordVector.end());
+      for (char& wordChar : word) {
+         wordChar = std::tolower(wordChar);
+      }
+      sink.insert(word);
+   }
+}
+
+/**
+ * Tokenizes the provided text the provided number of times with the
+ * provided read function and outputs the words found and megabytes
+ * tokenized per second
+ */
+template <typename Read>
+void benchTokenizer(const char* name, const std::string& text,
+   int rounds, Read read) {
+
+   double seconds = 0;
+   std::size_t numWords = 0;
+
+   for (int round = 0; round < rounds; round++) {
+      std::istringstream input(text);
+      WordCounter counter;
+      auto start = std::chrono::steady_clock::now();
+      read(input, counter);
+      auto stop = std::chrono::steady_clock::now();
+
+      seconds += std::chrono::duration<double>(stop - start).count();
+      numWords = counter.numWords;
+   }
+
+   std::cout << "   " << name << ": " << numWords << " words, "
+      << text.size() * rounds / seconds / 1e6 << " MB/s" << std::endl;
+}
+
+/**
+ * Compares the tokenizing throughput of WordTokenizer, with the
+ * default and a non-default word policy, against the tokenizer that
+ * WordTree used before it
+ */
+void benchTokenizers(const std::string& text, int rounds) {
+   std::cout << "tokenize (" << text.size() << " bytes)" << std::endl;
+   benchTokenizer("legacy istream::get", text, rounds, readLegacy);
+   benchTokenizer("DefaultWordPolicy  ", text, rounds,
+      [](std::istream& input, WordCounter& counter) {
+         WordTokenizer<DefaultWordPolicy>::read(input, counter);
+      });
+   benchTokenizer("FilteredWordPolicy ", text, rounds,
+      [](std::istream& input, WordCounter& counter) {
+         WordTokenizer<FilteredWordPolicy>::read(input, counter);
+      });
+}
+
+/**
+ * Inserts every word into a new Tree the provided number of times
+ * and outputs the heap bytes per unique word and the inserts per
+ * second. Both trees take the same already tokenized words by
+ * reference and compare each node once per insert, so the results
+ * differ only by node layout and key comparison.
+ */
+template <typename Tree>
+void benchTree(const char* name, const std::vector<std::string>& words,
+   int rounds) {
+
+   std::size_t before = allocatedBytes();
+   double seconds = 0;
+   int numWords = 0;
+   std::size_t bytes = 0;
+
+   for (int round = 0; round < rounds; round++) {
+      Tree tree;
+      auto start = std::chrono::steady_clock::now();
+      for (const std::string& word : words) {
+         tree.insert(word);
+      }
+      auto stop = std::chrono::steady_clock::now();
+
+      seconds += std::chrono::duration<double>(stop - start).count();
+      numWords = tree.numWords();
+      bytes = allocatedBytes() - before;
+   }
+
+   std::cout << "   " << name << ": "
+      << static_cast<double>(bytes) / numWords << " bytes per word, "
+      << words.size() * rounds / seconds / 1e6 << "M inserts/s"
+      << std::endl;
+}
+
+/**
+ * Runs every tree benchmark over the provided words
+ */
+void benchAll(const char* name, const std::vector<std::string>& words,
+   int rounds) {
+
+   std::cout << name << " (" << words.size() << " words)" << std::endl;
+   benchTree<WordTree>("WordTree      ", words, rounds);
+   benchTree<PackedWordTree>("PackedWordTree", words, rounds);
+}
+
+/**
+ * Inserts every word into a new WordTree in the provided mode and
+ * outputs the average depth per added word and the inserts per
+ * second.
+ *
+ * @return   the WordTree that the words were inserted into
+ */
+WordTree benchMode(const char* name, WordTree::TreeMode mode,
+   const std::vector<std::string>& words) {
+
+   WordTree tree(mode);
+   auto start = std::chrono::steady_clock::now();
+   for (const std::string& word : words) {
+      tree.insert(word);
+   }
+   auto stop = std::chrono::steady_clock::now();
+   double seconds = std::chrono::duration<double>(stop - start).count();
+
+   std::cout << "   " << name << ": " << tree.averageDepth()
+      << " average depth, " << words.size() / seconds / 1e6
+      << "M inserts/s" << std::endl;
+   return tree;
+}
+
+/**
+ * Retrieves the total depth of every word in a perfectly balanced
+ * tree built from the provided sorted counts, weighted by count.
+ * Like WordTree::averageDepth, the first occurrence of each word is
+ * charged only the WordNodes compared against before it is added,
+ * one less than its depth.
+ */
+double balancedDepth(const std::vector<long long>& counts,
+   std::size_t first, std::size_t last, int depth) {
+
+   if (first >= last) {
+      return 0;
+   }
+   std::size_t middle = first + (last - first) / 2;
+   return counts[middle] * static_cast<double>(depth) - 1 +
+      balancedDepth(counts, first, middle, depth + 1) +
+      balancedDepth(counts, middle + 1, last, depth + 1);
+}
+
+/**
+ * Compares the average depth per added word of every
+ * WordTree::TreeMode with a perfectly balanced tree of the same
+ * words
+ */
+void benchDepth(const char* name, const std::vector<std::string>& words) {
+   std::cout << name << " (" << words.size() << " words)" << std::endl;
+   WordTree plain = benchMode("plain             ",
+      WordTree::TreeMode::Plain, words);
+   benchMode("frequency adaptive",
+      WordTree::TreeMode::FrequencyAdaptive, words);
+
+   // exactCounts is ordered by word, like the tree's in-order walk
+   std::vector<long long> counts;
+   for (const auto& entry : exactCounts(plain)) {
+      counts.push_back(entry.second);
+   }
+
+   std::cout << "   balanced          : "
+      << balancedDepth(counts, 0, counts.size(), 1) / words.size()
+      << " average depth" << std::endl;
+}
+
+/**
+ * Entry point for this benchmark.
+ */
+int main() {
+   std::stringstream input;
+   input << std::cin.rdbuf();
+
+   WordCollector text;
+   WordTokenizer<DefaultWordPolicy>::read(input, text);
+   benchTokenizers(input.str(), 300);
+   benchAll("text", text.words, 20);
+
+   // random lower case words of 2 to 14 letters, each seen 4 times
+   std::vector<std::string> vocabulary;
+   unsigned long long state = 42;
+   for (int idx = 0; idx < 100000; idx++) {
+      state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+      std::string word((state >> 60) % 13 + 2, 'a');
+      for (char& currChar : word) {
+         state = state * 6364136223846793005ULL +
+            1442695040888963407ULL;
+         currChar = static_cast<char>('a' + (state >> 33) % 26);
+      }
+      vocabulary.push_back(word);
+   }
+   std::vector<std::string> synthetic;
+   for (int round = 0; round < 4; round++) {
+      synthetic.insert(synthetic.end(), vocabulary.begin(),
+         vocabulary.end());
+   }
+   benchAll("synthetic", synthetic, 3);
+
+   benchDepth("text depth", text.words);
+
+   // Zipf distributed words of the synthetic vocabulary
+   std::vector<std::string> zipf = zipfWords(vocabulary, 1000000, state);
+   benchDepth("zipf depth", zipf);
+} // end WordTreeBench.cpp
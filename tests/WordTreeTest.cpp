@@ -8,8 +8,20 @@
  */
 
 #include <iostream>
+#include <algorithm>
 #include <cassert>
+#include <climits>
+#include <cmath>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "ApproxWordCounter.h"
+#include "PackedWordTree.h"
 #include "WordTree.h"
+#include "WordTokenizer.h"
+#include "TestWords.h"
 
 
 /**
@@ -78,6 +90,309 @@ void testWordTreeInput() {
    std::cin >> testWordTree;
 }
 
+/**
+ * Sink for WordTokenizer tests that records every word it is given
+ */
+struct WordRecorder {
+   std::string words;
+
+   void insert(const std::string& aWord) {
+      words += aWord + " ";
+   }
+};
+
+/**
+ * Tokenizes the provided text with the provided word policy
+ */
+template <typename Policy>
+std::string tokenize(const std::string& text) {
+   std::istringstream input(text);
+   WordRecorder recorder;
+   WordTokenizer<Policy>::read(input, recorder);
+   return recorder.words;
+}
+
+/**
+ * Word policy which keeps case, discards words with digits and
+ * splits on single quotation marks
+ */
+struct StrictWordPolicy : DefaultWordPolicy {
+   static constexpr bool foldCase = false;
+   static constexpr ApostropheRule apostrophes = ApostropheRule::Split;
+   static constexpr DigitRule digits = DigitRule::Discard;
+};
+
+/**
+ * Word policy which keeps digits, skips short words and skips "the"
+ */
+struct FilteredWordPolicy : DefaultWordPolicy {
+   static constexpr DigitRule digits = DigitRule::Keep;
+   static constexpr std::size_t minLength = 2;
+   static constexpr bool filterStopwords = true;
+
+   static bool isStopword(const std::string& word) {
+      return word == "the";
+   }
+};
+
+/**
+ * Tests WordTokenizer default word policy
+ */
+void testWordTokenizerDefaultPolicy() {
+   assert(tokenize<DefaultWordPolicy>("The 'cat's' toys, ab1cd.") ==
+      "the cat's toys ab cd ");
+   assert(tokenize<DefaultWordPolicy>("rock'n'roll'' 42") ==
+      "rock'n'roll' ");
+}
+
+/**
+ * Tests WordTokenizer with custom word policies
+ */
+void testWordTokenizerCustomPolicy() {
+   assert(tokenize<StrictWordPolicy>("The 'cat's' toys, ab1cd.") ==
+      "The cat s toys ");
+   assert(tokenize<FilteredWordPolicy>("The a ab1cd 42 x9") ==
+      "ab1cd 42 x9 ");
+}
+
+/**
+ * Tests WordTree input with the default word policy
+ */
+void testWordTreeInputPolicy() {
+   WordTree testWordTree;
+   std::istringstream input("Test test, TEST's test'");
+   input >> testWordTree;
+   assert(testWordTree.numWords() == 2);
+
+   std::ostringstream output;
+   output << testWordTree;
+   assert(output.str() == "test 3\ntest's 1\n");
+}
+
+/**
+ * Checks an ApproxWordCounter against the exact counts of the same
+ * words: estimates never undercount, rarely exceed the error bound,
+ * and the heavy hitters are the most frequent words.
+ */
+void checkApproxCounts(const ApproxWordCounter& counter,
+   const std::map<std::string, long long>& counts) {
+
+   long long total = 0;
+   int overBound = 0;
+   std::vector<long long> exactTop;
+   for (const auto& entry : counts) {
+      long long estimate = counter.estimate(entry.first);
+      assert(estimate >= entry.second);
+      if (estimate - entry.second > counter.errorBound()) {
+         overBound++;
+      }
+      total += entry.second;
+      exactTop.push_back(entry.second);
+   }
+   assert(counter.numWords() == total);
+   assert(overBound <= counter.failureProbability() * counts.size());
+
+   std::vector<ApproxWordCounter::HeavyHitter> top = counter.topWords();
+   std::sort(exactTop.rbegin(), exactTop.rend());
+   for (std::size_t idx = 0; idx < top.size(); idx++) {
+      assert(top[idx].count >= counts.at(top[idx].item));
+      assert(std::abs(top[idx].count - exactTop[idx]) <=
+         counter.errorBound());
+   }
+}
+
+/**
+ * Tests ApproxWordCounter add and estimate
+ */
+void testApproxWordCounterAdd() {
+   ApproxWordCounter testCounter(64, 4, 2);
+   testCounter.insert("test");
+   testCounter.insert("another");
+   testCounter.insert("test");
+   testCounter.insert("again");
+   testCounter.insert("test");
+
+   assert(testCounter.numWords() == 5);
+   assert(testCounter.estimate("test") >= 3);
+   assert(testCounter.estimate("again") >= 1);
+
+   std::vector<ApproxWordCounter::HeavyHitter> top =
+      testCounter.topWords();
+   assert(top.size() == 2);
+   assert(top[0].item == "test");
+}
+
+/**
+ * Tests ApproxWordCounter rejects sizes that are not positive
+ */
+void testApproxWordCounterInvalidSizes() {
+   int sizes[][3] = {{0, 4, 10}, {64, 0, 10}, {64, 4, 0}, {64, 4, -3}};
+   for (const auto& size : sizes) {
+      bool thrown = false;
+      try {
+         ApproxWordCounter testCounter(size[0], size[1], size[2]);
+      }
+      catch (const std::invalid_argument&) {
+         thrown = true;
+      }
+      assert(thrown);
+   }
+}
+
+/**
+ * Tests ApproxWordCounter with far more heavy hitters than words
+ * does not allocate for the unused ones
+ */
+void testApproxWordCounterLargeHitters() {
+   ApproxWordCounter testCounter(64, 4, INT_MAX);
+   testCounter.insert("test");
+   testCounter.insert("another");
+   testCounter.insert("test");
+
+   std::vector<ApproxWordCounter::HeavyHitter> top =
+      testCounter.topWords();
+   assert(top.size() == 2);
+   assert(top[0].item == "test");
+}
+
+/**
+ * Tests ApproxWordCounter against WordTree on rapunzel.txt
+ */
+void testApproxWordCounterRapunzel() {
+   std::string text = readRapunzel();
+
+   WordTree testWordTree;
+   std::istringstream treeInput(text);
+   treeInput >> testWordTree;
+
+   ApproxWordCounter testCounter(1024, 4, 10);
+   std::istringstream counterInput(text);
+   counterInput >> testCounter;
+
+   checkApproxCounts(testCounter, exactCounts(testWordTree));
+}
+
+/**
+ * Tests ApproxWordCounter against WordTree on Zipf distributed words
+ */
+void testApproxWordCounterZipf() {
+   std::vector<std::string> vocabulary;
+   for (int rank = 0; rank < 5000; rank++) {
+      vocabulary.push_back("word" + std::to_string(rank));
+   }
+
+   WordTree testWordTree;
+   ApproxWordCounter testCounter(2048, 4, 20);
+   for (const std::string& word : zipfWords(vocabulary, 200000, 42)) {
+      testWordTree.insert(word);
+      testCounter.insert(word);
+   }
+
+   checkApproxCounts(testCounter, exactCounts(testWordTree));
+}
+
+/**
+ * Tests PackedWordTree add and output against WordTree, including
+ * words that share their first 8 bytes
+ */
+void testPackedWordTreeAdd() {
+   PackedWordTree testPackedTree;
+   assert(testPackedTree.numWords() == 0);
+
+   WordTree testWordTree;
+   std::vector<std::string> words = {"test", "Test", "another",
+      "internationalization", "internal", "internals", "intern",
+      "internationally", "a", "internal", "intern", "zebra"};
+   for (const std::string& word : words) {
+      testPackedTree.add(word);
+      testWordTree.add(word);
+   }
+   assert(testPackedTree.numWords() == testWordTree.numWords());
+
+   std::ostringstream packedOutput;
+   std::ostringstream treeOutput;
+   packedOutput << testPackedTree;
+   treeOutput << testWordTree;
+   assert(packedOutput.str() == treeOutput.str());
+
+   PackedWordTree copiedTree(testPackedTree);
+   copiedTree.add("zebra");
+   assert(copiedTree.numWords() == testPackedTree.numWords());
+}
+
+/**
+ * Tests PackedWordTree input against WordTree on rapunzel.txt
+ */
+void testPackedWordTreeRapunzel() {
+   std::string text = readRapunzel();
+
+   PackedWordTree testPackedTree;
+   std::istringstream packedInput(text);
+   packedInput >> testPackedTree;
+
+   WordTree testWordTree;
+   std::istringstream treeInput(text);
+   treeInput >> testWordTree;
+
+   std::ostringstream packedOutput;
+   std::ostringstream treeOutput;
+   packedOutput << testPackedTree;
+   treeOutput << testWordTree;
+   assert(packedOutput.str() == treeOutput.str());
+}
+
+/**
+ * Tests WordTree in TreeMode::FrequencyAdaptive against
+ * TreeMode::Plain
+ */
+void testWordTreeFrequencyAdaptive() {
+   WordTree plainTree;
+   WordTree adaptiveTree(WordTree::TreeMode::FrequencyAdaptive);
+   assert(adaptiveTree.averageDepth() == 0);
+
+   // sorted words leave a plain tree as a single long branch
+   std::vector<std::string> words = {"a", "b", "c", "d", "e", "f",
+      "g", "h", "i", "j"};
+   for (int round = 0; round < 10; round++) {
+      words.push_back("j");
+   }
+   for (const std::string& word : words) {
+      plainTree.add(word);
+      adaptiveTree.add(word);
+   }
+   assert(adaptiveTree.numWords() == plainTree.numWords());
+   assert(adaptiveTree.averageDepth() < plainTree.averageDepth());
+
+   std::ostringstream plainOutput;
+   std::ostringstream adaptiveOutput;
+   plainOutput << plainTree;
+   adaptiveOutput << adaptiveTree;
+   assert(adaptiveOutput.str() == plainOutput.str());
+
+   WordTree copiedTree(adaptiveTree);
+   copiedTree.add("a");
+   copiedTree.add("k");
+   assert(copiedTree.numWords() == adaptiveTree.numWords() + 1);
+}
+
+/**
+ * Tests WordTree in TreeMode::FrequencyAdaptive on rapunzel.txt
+ */
+void testWordTreeFrequencyAdaptiveRapunzel() {
+   std::string text = readRapunzel();
+
+   WordTree plainTree;
+   std::istringstream plainInput(text);
+   plainInput >> plainTree;
+
+   WordTree adaptiveTree(WordTree::TreeMode::FrequencyAdaptive);
+   std::istringstream adaptiveInput(text);
+   adaptiveInput >> adaptiveTree;
+
+   assert(adaptiveTree.averageDepth() < plainTree.averageDepth());
+   assert(exactCounts(adaptiveTree) == exactCounts(plainTree));
+}
+
 /**
  * A single method with all of the tests used to assess structure
  * and feature requirements of Queue classes
@@ -87,6 +402,18 @@ void runAllTests() {
    testWordTreeAddSingleNode();
    testWordTreeAddMultipleNode();
    testWordTreeOutput();
+   testWordTokenizerDefaultPolicy();
+   testWordTokenizerCustomPolicy();
+   testWordTreeInputPolicy();
+   testApproxWordCounterAdd();
+   testApproxWordCounterInvalidSizes();
+   testApproxWordCounterLargeHitters();
+   testApproxWordCounterRapunzel();
+   testApproxWordCounterZipf();
+   testPackedWordTreeAdd();
+   testPackedWordTreeRapunzel();
+   testWordTreeFrequencyAdaptive();
+   testWordTreeFrequencyAdaptiveRapunzel();
    testWordTreeInput();
 }
 